@@ -0,0 +1,16 @@
+#pragma once
+
+namespace papr {
+
+// The scene canvas is a 4bpp sprite whose palette is a 16-step gray ramp:
+// index 0 is black and index 15 is white. TFT_BLACK/TFT_WHITE land on those ends;
+// intermediate grays are drawn by passing the palette index as the color.
+constexpr int kCanvasGrayLevels = 16;
+
+// Palette index for an ink level (0 = no ink/white, 15 = full ink/black).
+constexpr int CanvasGrayIndex(int ink)
+{
+  return (kCanvasGrayLevels - 1) - ink;
+}
+
+} // namespace papr
@@ -0,0 +1,290 @@
+#include "chart_renderer.h"
+
+#include "scene_geometry.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+namespace papr {
+
+namespace {
+
+constexpr size_t kDefaultSeriesCapacity = 2048;
+constexpr size_t kMaxSeriesCapacity = 16384;
+constexpr size_t kMaxRetainedSeries = 8;
+
+enum class ChartType {
+  Line,
+  Step,
+  Bar
+};
+
+struct RetainedSeries {
+  String seriesId;
+  size_t capacity;
+  uint32_t updatedInPass;
+  bool usedInScene;
+  std::vector<float> values;
+};
+
+struct ColumnRange {
+  float first;
+  float last;
+  float min;
+  float max;
+};
+
+std::vector<RetainedSeries> retainedSeries;
+uint32_t updatePass = 0;
+
+ChartType ParseChartType(JsonObjectConst shape)
+{
+  const char* type = shape["ChartType"] | "Line";
+  if (strcmp(type, "Step") == 0) {
+    return ChartType::Step;
+  }
+
+  if (strcmp(type, "Bar") == 0) {
+    return ChartType::Bar;
+  }
+
+  return ChartType::Line;
+}
+
+size_t GetRequestedCapacity(JsonObjectConst shape)
+{
+  const int capacity = shape["Capacity"] | static_cast<int>(kDefaultSeriesCapacity);
+  return static_cast<size_t>(constrain(capacity, 1, static_cast<int>(kMaxSeriesCapacity)));
+}
+
+void AppendValues(std::vector<float>& out, JsonArrayConst values)
+{
+  for (JsonVariantConst v : values) {
+    out.push_back(v.as<float>());
+  }
+}
+
+void TrimToCapacity(std::vector<float>& values, size_t capacity)
+{
+  if (values.size() > capacity) {
+    values.erase(values.begin(), values.begin() + static_cast<long>(values.size() - capacity));
+  }
+}
+
+RetainedSeries* FindSeries(const char* seriesId)
+{
+  for (RetainedSeries& series : retainedSeries) {
+    if (series.seriesId == seriesId) {
+      return &series;
+    }
+  }
+
+  return nullptr;
+}
+
+RetainedSeries& CreateSeries(const char* seriesId, size_t capacity)
+{
+  if (retainedSeries.size() >= kMaxRetainedSeries) {
+    Serial.printf("Chart: evicting series '%s'\n", retainedSeries.front().seriesId.c_str());
+    retainedSeries.erase(retainedSeries.begin());
+  }
+
+  retainedSeries.push_back({String(seriesId), capacity, 0, false, {}});
+  return retainedSeries.back();
+}
+
+// `Values` replaces the series and fixes its capacity (never below the samples sent,
+// never above kMaxSeriesCapacity); `Append` extends it within the stored capacity.
+// A series is updated at most once per pass, however many shapes reference it.
+void ApplySeriesUpdate(JsonObjectConst shape)
+{
+  const char* seriesId = shape["SeriesId"] | "";
+  if (seriesId[0] == '\0') {
+    return;
+  }
+
+  RetainedSeries* series = FindSeries(seriesId);
+  if (series != nullptr && series->updatedInPass == updatePass) {
+    return;
+  }
+
+  const JsonArrayConst values = shape["Values"].as<JsonArrayConst>();
+  const JsonArrayConst append = shape["Append"].as<JsonArrayConst>();
+
+  if (!values.isNull()) {
+    if (series == nullptr) {
+      series = &CreateSeries(seriesId, 0);
+    }
+
+    series->values.clear();
+    AppendValues(series->values, values);
+    series->capacity = min(max(GetRequestedCapacity(shape), series->values.size()), kMaxSeriesCapacity);
+    TrimToCapacity(series->values, series->capacity);
+  }
+
+  if (series == nullptr) {
+    // The host resends `Values` when it sees this (e.g. after a reboot or release).
+    Serial.printf("Chart: unknown series '%s'\n", seriesId);
+    return;
+  }
+
+  if (!append.isNull()) {
+    AppendValues(series->values, append);
+    TrimToCapacity(series->values, series->capacity);
+  }
+
+  series->updatedInPass = updatePass;
+}
+
+void ApplySceneSeriesUpdates(JsonArrayConst shapes)
+{
+  ++updatePass;
+  for (JsonObjectConst shape : shapes) {
+    if (strcmp(shape["Kind"] | "", "Chart") == 0) {
+      ApplySeriesUpdate(shape);
+    }
+  }
+}
+
+// Collapses samples [begin, end) into the range one pixel column has to cover.
+ColumnRange ReduceColumn(const std::vector<float>& values, size_t begin, size_t end)
+{
+  ColumnRange range = {values[begin], values[end - 1], values[begin], values[begin]};
+  for (size_t i = begin + 1; i < end; ++i) {
+    range.min = min(range.min, values[i]);
+    range.max = max(range.max, values[i]);
+  }
+
+  return range;
+}
+
+int MapY(float v, float minY, float maxY, int dstY, int dstH)
+{
+  const double t = (static_cast<double>(v) - minY) / (static_cast<double>(maxY) - minY);
+  return dstY + (dstH - 1) - IRound(constrain(t, 0.0, 1.0) * (dstH - 1));
+}
+
+void DrawBar(M5Canvas& canvas, int x, int w, int baselineY, int valueY)
+{
+  const int top = min(baselineY, valueY);
+  const int h = abs(valueY - baselineY) + 1;
+  canvas.fillRect(x, top, max(1, w), h, TFT_BLACK);
+}
+
+} // namespace
+
+void UpdateChartSeries(JsonArrayConst shapes)
+{
+  ApplySceneSeriesUpdates(shapes);
+}
+
+void BeginChartScene(JsonArrayConst shapes)
+{
+  for (RetainedSeries& series : retainedSeries) {
+    series.usedInScene = false;
+  }
+
+  ApplySceneSeriesUpdates(shapes);
+}
+
+void EndChartScene()
+{
+  for (auto it = retainedSeries.begin(); it != retainedSeries.end();) {
+    if (it->usedInScene) {
+      ++it;
+    } else {
+      it = retainedSeries.erase(it);
+    }
+  }
+}
+
+bool RenderChart(M5Canvas& canvas, JsonObjectConst shape, int dstX, int dstY, int dstW, int dstH, int lineWeight)
+{
+  const char* seriesId = shape["SeriesId"] | "";
+  std::vector<float> inlineValues;
+  const std::vector<float>* values = &inlineValues;
+
+  if (seriesId[0] != '\0') {
+    RetainedSeries* series = FindSeries(seriesId);
+    if (series != nullptr) {
+      series->usedInScene = true;
+      values = &series->values;
+    }
+  } else {
+    AppendValues(inlineValues, shape["Values"].as<JsonArrayConst>());
+  }
+
+  const size_t n = values->size();
+  if (n == 0 || dstW < 2 || dstH < 2) {
+    Serial.printf("Chart: nothing to draw SeriesId='%s' Samples=%u W=%d H=%d\n", seriesId, static_cast<unsigned>(n), dstW, dstH);
+    return false;
+  }
+
+  float minY = FLT_MAX;
+  float maxY = -FLT_MAX;
+  for (float v : *values) {
+    minY = min(minY, v);
+    maxY = max(maxY, v);
+  }
+
+  minY = shape["MinY"] | minY;
+  maxY = shape["MaxY"] | maxY;
+  if (!(maxY > minY)) {
+    maxY = minY + 1.0f;
+  }
+
+  const ChartType type = ParseChartType(shape);
+  const int baselineY = MapY(constrain(0.0f, minY, maxY), minY, maxY, dstY, dstH);
+
+  if (shape["ShowAxes"] | true) {
+    canvas.drawFastVLine(dstX, dstY, dstH, TFT_BLACK);
+    canvas.drawFastHLine(dstX, baselineY, dstW, TFT_BLACK);
+  }
+
+  // Min/max decimation: every pixel column covers a contiguous sample range and
+  // is reduced in a single pass, so drawing cost is bounded by dstW, not n.
+  const size_t columns = min(n, static_cast<size_t>(dstW));
+  const int barWidth = max(1, (dstW / static_cast<int>(columns)) - 1);
+  Vec2 prev = {0, 0};
+
+  for (size_t c = 0; c < columns; ++c) {
+    const size_t begin = (c * n) / columns;
+    const size_t end = max(begin + 1, ((c + 1) * n) / columns);
+    const ColumnRange range = ReduceColumn(*values, begin, end);
+
+    const int x = (columns == 1) ? dstX : dstX + static_cast<int>((c * (dstW - 1)) / (columns - 1));
+    const int yMin = MapY(range.min, minY, maxY, dstY, dstH);
+    const int yMax = MapY(range.max, minY, maxY, dstY, dstH);
+    const Vec2 first = {static_cast<double>(x), static_cast<double>(MapY(range.first, minY, maxY, dstY, dstH))};
+    const Vec2 last = {static_cast<double>(x), static_cast<double>(MapY(range.last, minY, maxY, dstY, dstH))};
+
+    if (type == ChartType::Bar) {
+      const int barX = dstX + static_cast<int>((c * dstW) / columns);
+      const int peakY = (range.max > 0.0f || range.min >= 0.0f) ? yMax : yMin;
+      DrawBar(canvas, barX, barWidth, baselineY, peakY);
+      continue;
+    }
+
+    if (c > 0) {
+      if (type == ChartType::Step) {
+        const Vec2 corner = {first.x, prev.y};
+        DrawLine(canvas, prev, corner, lineWeight);
+        DrawLine(canvas, corner, first, lineWeight);
+      } else {
+        DrawLine(canvas, prev, first, lineWeight);
+      }
+    }
+
+    if (yMin != yMax || columns == 1) {
+      canvas.fillRect(x - ((lineWeight - 1) / 2), yMax, lineWeight, (yMin - yMax) + 1, TFT_BLACK);
+    }
+
+    prev = last;
+  }
+
+  return true;
+}
+
+} // namespace papr
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <ArduinoJson.h>
+#include <M5Unified.h>
+
+namespace papr {
+
+// Applies the Chart shapes' `Values`/`Append` of one scene to the series retained
+// under their `SeriesId` without drawing anything.
+void UpdateChartSeries(JsonArrayConst shapes);
+// Bracket a scene render: Begin applies the scene's series updates once per
+// `SeriesId`; End releases retained series not drawn in between.
+void BeginChartScene(JsonArrayConst shapes);
+void EndChartScene();
+bool RenderChart(M5Canvas& canvas, JsonObjectConst shape, int dstX, int dstY, int dstW, int dstH, int lineWeight);
+
+} // namespace papr
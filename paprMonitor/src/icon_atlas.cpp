@@ -0,0 +1,1004 @@
+#include "icon_atlas.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace papr {
+
+namespace {
+
+constexpr size_t kIconSizeCount = 3;
+
+struct IconBitmap {
+  uint8_t size;
+  const uint8_t* bits;
+};
+
+struct IconEntry {
+  const char* key;
+  IconBitmap bitmaps[kIconSizeCount];
+};
+
+// Bitmaps are packed row-major, MSB-first, each row padded to a whole byte.
+constexpr uint8_t kIconAlert16[] = {
+  0x00, 0x00, 0x01, 0x80,
+  0x01, 0x80, 0x03, 0xC0,
+  0x02, 0x40, 0x07, 0xE0,
+  0x0D, 0xB0, 0x0D, 0xB0,
+  0x19, 0x98, 0x19, 0x98,
+  0x30, 0x0C, 0x30, 0x0C,
+  0x61, 0x86, 0x7F, 0xFE,
+  0x7F, 0xFE, 0x00, 0x00
+};
+
+constexpr uint8_t kIconAlert24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00,
+  0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00,
+  0x00, 0x7E, 0x00,
+  0x00, 0x66, 0x00,
+  0x00, 0xC3, 0x00,
+  0x00, 0xDB, 0x00,
+  0x01, 0x99, 0x80,
+  0x03, 0x99, 0xC0,
+  0x03, 0x18, 0xC0,
+  0x07, 0x18, 0xE0,
+  0x06, 0x18, 0x60,
+  0x0E, 0x18, 0x70,
+  0x0C, 0x00, 0x30,
+  0x1C, 0x00, 0x38,
+  0x18, 0x18, 0x18,
+  0x38, 0x18, 0x1C,
+  0x30, 0x00, 0x0C,
+  0x7F, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xFE,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconAlert32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x0E, 0x70, 0x00,
+  0x00, 0x0E, 0x70, 0x00,
+  0x00, 0x1C, 0x38, 0x00,
+  0x00, 0x3D, 0xBC, 0x00,
+  0x00, 0x3B, 0xDC, 0x00,
+  0x00, 0x7B, 0xDE, 0x00,
+  0x00, 0x73, 0xCE, 0x00,
+  0x00, 0xE3, 0xC7, 0x00,
+  0x00, 0xE3, 0xC7, 0x00,
+  0x01, 0xC3, 0xC3, 0x80,
+  0x01, 0xC3, 0xC3, 0x80,
+  0x03, 0x83, 0xC1, 0xC0,
+  0x03, 0x81, 0x81, 0xC0,
+  0x07, 0x00, 0x00, 0xE0,
+  0x07, 0x00, 0x00, 0xE0,
+  0x0E, 0x00, 0x00, 0x70,
+  0x1E, 0x01, 0x80, 0x78,
+  0x1C, 0x03, 0xC0, 0x38,
+  0x3C, 0x01, 0x80, 0x3C,
+  0x38, 0x00, 0x00, 0x1C,
+  0x7F, 0xFF, 0xFF, 0xFE,
+  0x7F, 0xFF, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryEmpty16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x40, 0x0C, 0x40, 0x0E,
+  0x40, 0x0E, 0x40, 0x0C,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryEmpty24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xF0,
+  0x70, 0x00, 0x30,
+  0x70, 0x00, 0x30,
+  0x70, 0x00, 0x3C,
+  0x70, 0x00, 0x3C,
+  0x70, 0x00, 0x3C,
+  0x70, 0x00, 0x3C,
+  0x70, 0x00, 0x30,
+  0x70, 0x00, 0x30,
+  0x7F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryEmpty32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x38, 0x00, 0x00, 0xF8,
+  0x38, 0x00, 0x00, 0xFC,
+  0x38, 0x00, 0x00, 0xFC,
+  0x38, 0x00, 0x00, 0xFC,
+  0x38, 0x00, 0x00, 0xFC,
+  0x38, 0x00, 0x00, 0xF8,
+  0x38, 0x00, 0x00, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryFull16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x5F, 0xFC, 0x5F, 0xFE,
+  0x5F, 0xFE, 0x5F, 0xFC,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryFull24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xF0,
+  0x70, 0x00, 0x30,
+  0x7F, 0xFF, 0xB0,
+  0x7F, 0xFF, 0xBC,
+  0x7F, 0xFF, 0xBC,
+  0x7F, 0xFF, 0xBC,
+  0x7F, 0xFF, 0xBC,
+  0x7F, 0xFF, 0xB0,
+  0x70, 0x00, 0x30,
+  0x7F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryFull32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3B, 0xFF, 0xFE, 0xE0,
+  0x3B, 0xFF, 0xFE, 0xF8,
+  0x3B, 0xFF, 0xFE, 0xFC,
+  0x3B, 0xFF, 0xFE, 0xFC,
+  0x3B, 0xFF, 0xFE, 0xFC,
+  0x3B, 0xFF, 0xFE, 0xFC,
+  0x3B, 0xFF, 0xFE, 0xF8,
+  0x3B, 0xFF, 0xFE, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryHalf16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x5E, 0x0C, 0x5E, 0x0E,
+  0x5E, 0x0E, 0x5E, 0x0C,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryHalf24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xF0,
+  0x70, 0x00, 0x30,
+  0x7F, 0xE0, 0x30,
+  0x7F, 0xE0, 0x3C,
+  0x7F, 0xE0, 0x3C,
+  0x7F, 0xE0, 0x3C,
+  0x7F, 0xE0, 0x3C,
+  0x7F, 0xE0, 0x30,
+  0x70, 0x00, 0x30,
+  0x7F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryHalf32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3B, 0xFC, 0x00, 0xE0,
+  0x3B, 0xFE, 0x00, 0xF8,
+  0x3B, 0xFE, 0x00, 0xFC,
+  0x3B, 0xFE, 0x00, 0xFC,
+  0x3B, 0xFE, 0x00, 0xFC,
+  0x3B, 0xFE, 0x00, 0xFC,
+  0x3B, 0xFE, 0x00, 0xF8,
+  0x3B, 0xFC, 0x00, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryLow16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x58, 0x0C, 0x58, 0x0E,
+  0x58, 0x0E, 0x58, 0x0C,
+  0x7F, 0xFC, 0x7F, 0xFC,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryLow24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xF0,
+  0x70, 0x00, 0x30,
+  0x7E, 0x00, 0x30,
+  0x7E, 0x00, 0x3C,
+  0x7E, 0x00, 0x3C,
+  0x7E, 0x00, 0x3C,
+  0x7E, 0x00, 0x3C,
+  0x7E, 0x00, 0x30,
+  0x70, 0x00, 0x30,
+  0x7F, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconBatteryLow32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3B, 0x80, 0x00, 0xE0,
+  0x3B, 0x80, 0x00, 0xF8,
+  0x3B, 0x80, 0x00, 0xFC,
+  0x3B, 0x80, 0x00, 0xFC,
+  0x3B, 0x80, 0x00, 0xFC,
+  0x3B, 0x80, 0x00, 0xFC,
+  0x3B, 0x80, 0x00, 0xF8,
+  0x3B, 0x80, 0x00, 0xE0,
+  0x38, 0x00, 0x00, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCheck16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06,
+  0x00, 0x0E, 0x00, 0x1C,
+  0x00, 0x38, 0x20, 0x70,
+  0x70, 0x60, 0x38, 0xC0,
+  0x1D, 0xC0, 0x0F, 0x80,
+  0x07, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCheck24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04,
+  0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x38,
+  0x00, 0x00, 0x78,
+  0x00, 0x00, 0xF0,
+  0x00, 0x01, 0xE0,
+  0x30, 0x03, 0xC0,
+  0x38, 0x07, 0x80,
+  0x3C, 0x0F, 0x00,
+  0x1E, 0x1E, 0x00,
+  0x0F, 0x1C, 0x00,
+  0x07, 0xF8, 0x00,
+  0x03, 0xF8, 0x00,
+  0x01, 0xF0, 0x00,
+  0x00, 0xE0, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCheck32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C,
+  0x00, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x03, 0xE0,
+  0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x00, 0x0F, 0x80,
+  0x1C, 0x00, 0x1F, 0x00,
+  0x1E, 0x00, 0x3E, 0x00,
+  0x1F, 0x00, 0x7C, 0x00,
+  0x0F, 0x80, 0xF8, 0x00,
+  0x07, 0xC1, 0xF0, 0x00,
+  0x03, 0xE3, 0xE0, 0x00,
+  0x01, 0xF7, 0xC0, 0x00,
+  0x00, 0xFF, 0x80, 0x00,
+  0x00, 0x7F, 0x80, 0x00,
+  0x00, 0x3F, 0x00, 0x00,
+  0x00, 0x1E, 0x00, 0x00,
+  0x00, 0x0C, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCloud16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x01, 0xC0, 0x03, 0xE0,
+  0x07, 0xF0, 0x0F, 0xF8,
+  0x1F, 0xFC, 0x3F, 0xFC,
+  0x1F, 0xFC, 0x1F, 0xF8,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCloud24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x1C, 0x00,
+  0x00, 0x7F, 0x00,
+  0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80,
+  0x01, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x07, 0xFF, 0xF0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCloud32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xC0, 0x00,
+  0x00, 0x07, 0xF8, 0x00,
+  0x00, 0x0F, 0xFC, 0x00,
+  0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xE0,
+  0x01, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCross16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x30, 0x0C, 0x38, 0x1C,
+  0x1C, 0x38, 0x0E, 0x70,
+  0x07, 0xE0, 0x03, 0xC0,
+  0x03, 0xC0, 0x07, 0xE0,
+  0x0E, 0x70, 0x1C, 0x38,
+  0x38, 0x1C, 0x30, 0x0C,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCross24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x18, 0x00, 0x18,
+  0x1C, 0x00, 0x38,
+  0x0E, 0x00, 0x70,
+  0x07, 0x00, 0xE0,
+  0x03, 0x81, 0xC0,
+  0x01, 0xC3, 0x80,
+  0x00, 0xE7, 0x00,
+  0x00, 0x7E, 0x00,
+  0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00,
+  0x00, 0x7E, 0x00,
+  0x00, 0xE7, 0x00,
+  0x01, 0xC3, 0x80,
+  0x03, 0x81, 0xC0,
+  0x07, 0x00, 0xE0,
+  0x0E, 0x00, 0x70,
+  0x1C, 0x00, 0x38,
+  0x18, 0x00, 0x18,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconCross32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x0E, 0x00, 0x00, 0x70,
+  0x0F, 0x00, 0x00, 0xF0,
+  0x0F, 0x80, 0x01, 0xF0,
+  0x07, 0xC0, 0x03, 0xE0,
+  0x03, 0xE0, 0x07, 0xC0,
+  0x01, 0xF0, 0x0F, 0x80,
+  0x00, 0xF8, 0x1F, 0x00,
+  0x00, 0x7C, 0x3E, 0x00,
+  0x00, 0x3E, 0x7C, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x3E, 0x7C, 0x00,
+  0x00, 0x7C, 0x3E, 0x00,
+  0x00, 0xF8, 0x1F, 0x00,
+  0x01, 0xF0, 0x0F, 0x80,
+  0x03, 0xE0, 0x07, 0xC0,
+  0x07, 0xC0, 0x03, 0xE0,
+  0x0F, 0x80, 0x01, 0xF0,
+  0x0F, 0x00, 0x00, 0xF0,
+  0x0E, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconInfo16[] = {
+  0x01, 0x80, 0x0F, 0xF0,
+  0x1C, 0x38, 0x30, 0x0C,
+  0x61, 0x86, 0x61, 0x86,
+  0x41, 0x82, 0xC1, 0x83,
+  0xC1, 0x83, 0x41, 0x82,
+  0x61, 0x86, 0x61, 0x86,
+  0x31, 0x8C, 0x1C, 0x38,
+  0x0F, 0xF0, 0x01, 0x80
+};
+
+constexpr uint8_t kIconInfo24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00,
+  0x03, 0xFF, 0xC0,
+  0x07, 0x81, 0xE0,
+  0x0E, 0x00, 0x70,
+  0x1C, 0x00, 0x38,
+  0x38, 0x18, 0x1C,
+  0x30, 0x18, 0x0C,
+  0x70, 0x18, 0x0E,
+  0x60, 0x18, 0x06,
+  0x60, 0x18, 0x06,
+  0x60, 0x18, 0x06,
+  0x60, 0x18, 0x06,
+  0x60, 0x18, 0x06,
+  0x60, 0x18, 0x06,
+  0x70, 0x18, 0x0E,
+  0x30, 0x18, 0x0C,
+  0x38, 0x18, 0x1C,
+  0x1C, 0x18, 0x38,
+  0x0E, 0x00, 0x70,
+  0x07, 0x81, 0xE0,
+  0x03, 0xFF, 0xC0,
+  0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconInfo32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0xFF, 0xFF, 0x00,
+  0x01, 0xF0, 0x0F, 0x80,
+  0x03, 0xC0, 0x03, 0xC0,
+  0x07, 0x80, 0x01, 0xE0,
+  0x0E, 0x00, 0x00, 0x70,
+  0x1E, 0x03, 0xC0, 0x78,
+  0x1C, 0x03, 0xC0, 0x38,
+  0x38, 0x03, 0xC0, 0x1C,
+  0x38, 0x00, 0x00, 0x1C,
+  0x30, 0x00, 0x00, 0x0C,
+  0x70, 0x01, 0x80, 0x0E,
+  0x70, 0x03, 0xC0, 0x0E,
+  0x70, 0x03, 0xC0, 0x0E,
+  0x70, 0x03, 0xC0, 0x0E,
+  0x70, 0x03, 0xC0, 0x0E,
+  0x70, 0x03, 0xC0, 0x0E,
+  0x30, 0x03, 0xC0, 0x0C,
+  0x38, 0x03, 0xC0, 0x1C,
+  0x38, 0x03, 0xC0, 0x1C,
+  0x1C, 0x03, 0xC0, 0x38,
+  0x1E, 0x03, 0xC0, 0x78,
+  0x0E, 0x01, 0x80, 0x70,
+  0x07, 0x80, 0x01, 0xE0,
+  0x03, 0xC0, 0x03, 0xC0,
+  0x01, 0xF0, 0x0F, 0x80,
+  0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconRain16[] = {
+  0x00, 0x00, 0x03, 0xC0,
+  0x07, 0xE0, 0x07, 0xF0,
+  0x1F, 0xF8, 0x1F, 0xFC,
+  0x3F, 0xFC, 0x1F, 0xFC,
+  0x0F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x90,
+  0x04, 0xB0, 0x0D, 0xB0,
+  0x0D, 0xA0, 0x00, 0x00
+};
+
+constexpr uint8_t kIconRain24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00,
+  0x00, 0x7F, 0x00,
+  0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80,
+  0x01, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x07, 0xFF, 0xF0,
+  0x01, 0xFF, 0xC0,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x8C, 0x40,
+  0x00, 0xCC, 0xC0,
+  0x01, 0x8C, 0xC0,
+  0x01, 0x98, 0xC0,
+  0x01, 0x99, 0x80,
+  0x03, 0x19, 0x80,
+  0x03, 0x11, 0x80,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconRain32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xF0, 0x00,
+  0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFF, 0x00,
+  0x01, 0xFF, 0xFF, 0xC0,
+  0x03, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xE0,
+  0x01, 0xFF, 0xFF, 0xE0,
+  0x00, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0xC3, 0x00,
+  0x00, 0x38, 0xE7, 0x00,
+  0x00, 0x31, 0xC7, 0x00,
+  0x00, 0x71, 0xC7, 0x00,
+  0x00, 0x71, 0xC6, 0x00,
+  0x00, 0x71, 0x8E, 0x00,
+  0x00, 0xE3, 0x8E, 0x00,
+  0x00, 0xE3, 0x8E, 0x00,
+  0x00, 0x41, 0x0C, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconSnow16[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x03, 0xE0, 0x07, 0xE0,
+  0x07, 0xF0, 0x1F, 0xFC,
+  0x1F, 0xFC, 0x1F, 0xFC,
+  0x1F, 0xFC, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x30, 0x09, 0x90,
+  0x01, 0x80, 0x00, 0x00
+};
+
+constexpr uint8_t kIconSnow24[] = {
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x1C, 0x00,
+  0x00, 0x7F, 0x00,
+  0x00, 0xFF, 0x80,
+  0x00, 0xFF, 0x80,
+  0x01, 0xFF, 0xC0,
+  0x07, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xF8,
+  0x07, 0xFF, 0xF0,
+  0x00, 0xFF, 0x80,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x03, 0x00, 0xC0,
+  0x03, 0x00, 0xC0,
+  0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconSnow32[] = {
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xE0, 0x00,
+  0x00, 0x07, 0xF8, 0x00,
+  0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0x3F, 0xFE, 0x00,
+  0x00, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0xE0,
+  0x03, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x07, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFF, 0xE0,
+  0x00, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0xE0, 0x07, 0x00,
+  0x00, 0xE0, 0x07, 0x00,
+  0x00, 0xE0, 0x07, 0x00,
+  0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t kIconSun16[] = {
+  0x01, 0x80, 0x01, 0x80,
+  0x31, 0x8C, 0x38, 0x1C,
+  0x18, 0x18, 0x03, 0xC0,
+  0x07, 0xE0, 0xE7, 0xE7,
+  0xE7, 0xE7, 0x07, 0xE0,
+  0x03, 0xC0, 0x18, 0x18,
+  0x38, 0x1C, 0x31, 0x8C,
+  0x01, 0x80, 0x01, 0x80
+};
+
+constexpr uint8_t kIconSun24[] = {
+  0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  0x18, 0x18, 0x18,
+  0x1C, 0x18, 0x38,
+  0x0E, 0x00, 0x70,
+  0x07, 0x00, 0xE0,
+  0x02, 0x3C, 0x40,
+  0x00, 0x7E, 0x00,
+  0x00, 0xFF, 0x00,
+  0x01, 0xFF, 0x80,
+  0xF9, 0xFF, 0x9F,
+  0xF9, 0xFF, 0x9F,
+  0x01, 0xFF, 0x80,
+  0x00, 0xFF, 0x00,
+  0x00, 0x7E, 0x00,
+  0x02, 0x3C, 0x40,
+  0x07, 0x00, 0xE0,
+  0x0E, 0x00, 0x70,
+  0x1C, 0x18, 0x38,
+  0x18, 0x18, 0x18,
+  0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00,
+  0x00, 0x18, 0x00
+};
+
+constexpr uint8_t kIconSun32[] = {
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x04, 0x01, 0x80, 0x20,
+  0x0E, 0x01, 0x80, 0x70,
+  0x07, 0x01, 0x80, 0xE0,
+  0x03, 0x80, 0x01, 0xC0,
+  0x01, 0xC0, 0x03, 0x80,
+  0x00, 0xC0, 0x03, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x3F, 0xFC, 0x00,
+  0xFE, 0x3F, 0xFC, 0x7F,
+  0xFE, 0x3F, 0xFC, 0x7F,
+  0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x07, 0xE0, 0x00,
+  0x00, 0xC0, 0x03, 0x00,
+  0x01, 0xC0, 0x03, 0x80,
+  0x03, 0x80, 0x01, 0xC0,
+  0x07, 0x01, 0x80, 0xE0,
+  0x0E, 0x01, 0x80, 0x70,
+  0x04, 0x01, 0x80, 0x20,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00,
+  0x00, 0x01, 0x80, 0x00
+};
+
+constexpr IconEntry kIcons[] = {
+  {"alert", {{16, kIconAlert16}, {24, kIconAlert24}, {32, kIconAlert32}}},
+  {"battery_empty", {{16, kIconBatteryEmpty16}, {24, kIconBatteryEmpty24}, {32, kIconBatteryEmpty32}}},
+  {"battery_full", {{16, kIconBatteryFull16}, {24, kIconBatteryFull24}, {32, kIconBatteryFull32}}},
+  {"battery_half", {{16, kIconBatteryHalf16}, {24, kIconBatteryHalf24}, {32, kIconBatteryHalf32}}},
+  {"battery_low", {{16, kIconBatteryLow16}, {24, kIconBatteryLow24}, {32, kIconBatteryLow32}}},
+  {"check", {{16, kIconCheck16}, {24, kIconCheck24}, {32, kIconCheck32}}},
+  {"cloud", {{16, kIconCloud16}, {24, kIconCloud24}, {32, kIconCloud32}}},
+  {"cross", {{16, kIconCross16}, {24, kIconCross24}, {32, kIconCross32}}},
+  {"info", {{16, kIconInfo16}, {24, kIconInfo24}, {32, kIconInfo32}}},
+  {"rain", {{16, kIconRain16}, {24, kIconRain24}, {32, kIconRain32}}},
+  {"snow", {{16, kIconSnow16}, {24, kIconSnow24}, {32, kIconSnow32}}},
+  {"sun", {{16, kIconSun16}, {24, kIconSun24}, {32, kIconSun32}}}
+};
+
+constexpr size_t kIconCount = sizeof(kIcons) / sizeof(kIcons[0]);
+
+constexpr int CompareKeys(const char* a, const char* b)
+{
+  return (*a != *b || *a == '\0')
+    ? static_cast<int>(static_cast<unsigned char>(*a)) - static_cast<int>(static_cast<unsigned char>(*b))
+    : CompareKeys(a + 1, b + 1);
+}
+
+constexpr bool IsSortedFrom(size_t i)
+{
+  return (i + 1 >= kIconCount) || (CompareKeys(kIcons[i].key, kIcons[i + 1].key) < 0 && IsSortedFrom(i + 1));
+}
+
+static_assert(IsSortedFrom(0), "kIcons must be sorted by key for binary search");
+
+const IconEntry* FindIcon(const char* key)
+{
+  size_t lo = 0;
+  size_t hi = kIconCount;
+  while (lo < hi) {
+    const size_t mid = lo + ((hi - lo) / 2);
+    const int cmp = strcmp(kIcons[mid].key, key);
+    if (cmp == 0) {
+      return &kIcons[mid];
+    }
+
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return nullptr;
+}
+
+const IconBitmap& PickNearestBitmap(const IconEntry& entry, double size)
+{
+  size_t best = 0;
+  double bestDelta = fabs(static_cast<double>(entry.bitmaps[0].size) - size);
+  for (size_t i = 1; i < kIconSizeCount; ++i) {
+    const double delta = fabs(static_cast<double>(entry.bitmaps[i].size) - size);
+    if (delta < bestDelta) {
+      best = i;
+      bestDelta = delta;
+    }
+  }
+
+  return entry.bitmaps[best];
+}
+
+void BlitBitmap(M5Canvas& canvas, const IconBitmap& bitmap, int x, int y)
+{
+  const int size = bitmap.size;
+  const int stride = (size + 7) / 8;
+
+  for (int row = 0; row < size; ++row) {
+    const uint8_t* line = bitmap.bits + (row * stride);
+    int runStart = -1;
+
+    for (int col = 0; col <= size; ++col) {
+      const bool set = col < size && (line[col / 8] & (0x80u >> (col % 8))) != 0;
+      if (set && runStart < 0) {
+        runStart = col;
+      } else if (!set && runStart >= 0) {
+        canvas.drawFastHLine(x + runStart, y + row, col - runStart, TFT_BLACK);
+        runStart = -1;
+      }
+    }
+  }
+}
+
+} // namespace
+
+bool DrawAtlasIcon(M5Canvas& canvas, const String& key, int x, int y, double size)
+{
+  String normalized = key;
+  normalized.trim();
+  normalized.toLowerCase();
+
+  const IconEntry* entry = FindIcon(normalized.c_str());
+  if (entry == nullptr) {
+    return false;
+  }
+
+  BlitBitmap(canvas, PickNearestBitmap(*entry, size), x, y);
+  return true;
+}
+
+} // namespace papr
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <M5Unified.h>
+
+namespace papr {
+
+// Draws a built-in 1bpp icon with its top-left corner at (x, y), using the
+// native atlas size nearest to `size`. Returns false when `key` is unknown.
+bool DrawAtlasIcon(M5Canvas& canvas, const String& key, int x, int y, double size);
+
+} // namespace papr
@@ -1,5 +1,7 @@
 #include "image_matrix_renderer.h"
 
+#include "canvas_palette.h"
+
 #include <mbedtls/base64.h>
 #include <vector>
 
@@ -25,15 +27,27 @@ bool DecodeBase64(const String& encoded, std::vector<uint8_t>& out)
   return true;
 }
 
-bool ReadPackedBit(const std::vector<uint8_t>& data, size_t bitIndex)
+// 4x4 Bayer thresholds (0..15) used when a gray image is forced to black/white.
+constexpr uint8_t kBayer4x4[4][4] = {
+  {0, 8, 2, 10},
+  {12, 4, 14, 6},
+  {3, 11, 1, 9},
+  {15, 7, 13, 5}
+};
+
+bool IsSupportedBpp(int bpp)
 {
-  const size_t byteIndex = bitIndex / 8;
-  if (byteIndex >= data.size()) {
-    return false;
-  }
+  return bpp == 1 || bpp == 2 || bpp == 4;
+}
 
-  const uint8_t bitMask = static_cast<uint8_t>(1u << (7u - (bitIndex % 8u)));
-  return (data[byteIndex] & bitMask) != 0;
+// Maps every raw sample value to an ink level (0 = white, 15 = black) once per image.
+void BuildInkTable(int bpp, bool blackIsOne, uint8_t (&ink)[kCanvasGrayLevels])
+{
+  const int maxValue = (1 << bpp) - 1;
+  for (int v = 0; v <= maxValue; ++v) {
+    const int level = (v * (kCanvasGrayLevels - 1)) / maxValue;
+    ink[v] = static_cast<uint8_t>(blackIsOne ? level : (kCanvasGrayLevels - 1) - level);
+  }
 }
 
 } // namespace
@@ -50,6 +64,7 @@ bool RenderImageMatrix(M5Canvas& canvas, JsonObjectConst shape, int dstX, int ds
   const int srcH = matrix["Height"] | 0;
   const int bpp = matrix["Bpp"] | 1;
   const bool blackIsOne = matrix["BlackIsOne"] | true;
+  const bool dither = matrix["Dither"] | false;
 
   const JsonVariantConst dataVariant = matrix["Data"];
   const bool hasDataKey = !dataVariant.isNull();
@@ -61,14 +76,14 @@ bool RenderImageMatrix(M5Canvas& canvas, JsonObjectConst shape, int dstX, int ds
   }
   const int dataLen = dataBase64.length();
 
-  if (srcW <= 0 || srcH <= 0 || bpp != 1 || dataLen == 0) {
+  if (srcW <= 0 || srcH <= 0 || !IsSupportedBpp(bpp) || dataLen == 0) {
     Serial.printf("ImageMatrix: invalid metadata W=%d H=%d Bpp=%d HasData=%d HasDataLower=%d DataLen=%d\n",
                   srcW, srcH, bpp, hasDataKey ? 1 : 0, hasLowerDataKey ? 1 : 0, dataLen);
     return false;
   }
 
-  Serial.printf("ImageMatrix: metadata W=%d H=%d Bpp=%d BlackIsOne=%d DataLen=%d\n",
-                srcW, srcH, bpp, blackIsOne ? 1 : 0, dataLen);
+  Serial.printf("ImageMatrix: metadata W=%d H=%d Bpp=%d BlackIsOne=%d Dither=%d DataLen=%d\n",
+                srcW, srcH, bpp, blackIsOne ? 1 : 0, dither ? 1 : 0, dataLen);
 
   std::vector<uint8_t> packed;
   if (!DecodeBase64(dataBase64, packed)) {
@@ -76,7 +91,7 @@ bool RenderImageMatrix(M5Canvas& canvas, JsonObjectConst shape, int dstX, int ds
     return false;
   }
 
-  const size_t expectedBits = static_cast<size_t>(srcW) * static_cast<size_t>(srcH);
+  const size_t expectedBits = static_cast<size_t>(srcW) * static_cast<size_t>(srcH) * static_cast<size_t>(bpp);
   const size_t expectedBytes = (expectedBits + 7) / 8;
   if (packed.size() < expectedBytes) {
     Serial.printf("ImageMatrix: decoded bytes too small (%u < %u)\n",
@@ -85,6 +100,39 @@ bool RenderImageMatrix(M5Canvas& canvas, JsonObjectConst shape, int dstX, int ds
     return false;
   }
 
+  uint8_t* const pixels = static_cast<uint8_t*>(canvas.getBuffer());
+  if (pixels == nullptr || (canvas.getColorDepth() & 0xFF) != 4) {
+    Serial.println("ImageMatrix: canvas is not a 4bpp sprite");
+    return false;
+  }
+
+  const int clipX0 = max(0, dstX);
+  const int clipX1 = min(static_cast<int>(canvas.width()), dstX + dstW);
+  if (clipX0 >= clipX1) {
+    return true;
+  }
+
+  // Nearest-neighbor scaling table: source bit offset within a row for every visible column.
+  std::vector<uint32_t> srcBitX(static_cast<size_t>(clipX1 - clipX0));
+  for (int px = clipX0; px < clipX1; ++px) {
+    const int srcX = static_cast<int>((static_cast<long long>(px - dstX) * srcW) / dstW);
+    srcBitX[px - clipX0] = static_cast<uint32_t>(srcX * bpp);
+  }
+
+  uint8_t ink[kCanvasGrayLevels] = {};
+  BuildInkTable(bpp, blackIsOne, ink);
+
+  // Palette index per raw sample value for the undithered paths.
+  uint8_t sampleIndex[kCanvasGrayLevels] = {};
+  for (int v = 0; v < kCanvasGrayLevels; ++v) {
+    const bool black = ((ink[v] * kCanvasGrayLevels) / (kCanvasGrayLevels - 1)) > ((kCanvasGrayLevels / 2) - 1);
+    const int index = (bpp == 1) ? (black ? CanvasGrayIndex(kCanvasGrayLevels - 1) : CanvasGrayIndex(0)) : CanvasGrayIndex(ink[v]);
+    sampleIndex[v] = static_cast<uint8_t>(index);
+  }
+
+  const uint8_t sampleMask = static_cast<uint8_t>((1u << bpp) - 1u);
+  const size_t rowStride = static_cast<size_t>((canvas.width() + 1) / 2);
+
   for (int y = 0; y < dstH; ++y) {
     const int srcY = static_cast<int>((static_cast<long long>(y) * srcH) / dstH);
     const int py = dstY + y;
@@ -92,17 +140,35 @@ bool RenderImageMatrix(M5Canvas& canvas, JsonObjectConst shape, int dstX, int ds
       continue;
     }
 
-    for (int x = 0; x < dstW; ++x) {
-      const int srcX = static_cast<int>((static_cast<long long>(x) * srcW) / dstW);
-      const int px = dstX + x;
-      if (px < 0 || px >= canvas.width()) {
-        continue;
+    const size_t rowBit = static_cast<size_t>(srcY) * static_cast<size_t>(srcW) * static_cast<size_t>(bpp);
+    const uint8_t* bayerRow = kBayer4x4[py & 3];
+    uint8_t* dstRow = pixels + (static_cast<size_t>(py) * rowStride);
+
+    auto paletteIndexAt = [&](int px) -> uint8_t {
+      const size_t bit = rowBit + srcBitX[px - clipX0];
+      const uint8_t value = static_cast<uint8_t>((packed[bit >> 3] >> (8u - bpp - (bit & 7u))) & sampleMask);
+      if (!dither) {
+        return sampleIndex[value];
       }
 
-      const size_t bitIndex = (static_cast<size_t>(srcY) * static_cast<size_t>(srcW)) + static_cast<size_t>(srcX);
-      const bool bit = ReadPackedBit(packed, bitIndex);
-      const bool black = blackIsOne ? bit : !bit;
-      canvas.drawPixel(px, py, black ? TFT_BLACK : TFT_WHITE);
+      const bool black = ((ink[value] * kCanvasGrayLevels) / (kCanvasGrayLevels - 1)) > bayerRow[px & 3];
+      return static_cast<uint8_t>(black ? CanvasGrayIndex(kCanvasGrayLevels - 1) : CanvasGrayIndex(0));
+    };
+
+    // The sprite packs two pixels per byte, left pixel in the high nibble. Edge pixels
+    // that share a byte with content outside the image keep the other nibble.
+    int px = clipX0;
+    if (px & 1) {
+      dstRow[px >> 1] = static_cast<uint8_t>((dstRow[px >> 1] & 0xF0) | paletteIndexAt(px));
+      ++px;
+    }
+
+    for (; px + 1 < clipX1; px += 2) {
+      dstRow[px >> 1] = static_cast<uint8_t>((paletteIndexAt(px) << 4) | paletteIndexAt(px + 1));
+    }
+
+    if (px < clipX1) {
+      dstRow[px >> 1] = static_cast<uint8_t>((dstRow[px >> 1] & 0x0F) | (paletteIndexAt(px) << 4));
     }
   }
 
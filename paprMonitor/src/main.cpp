@@ -1,14 +1,20 @@
 #include <Arduino.h>
 #include <M5Unified.h>
 
+#include "scene_command_queue.h"
 #include "scene_renderer.h"
 
 M5Canvas canvas(&M5.Display);
 String inputLine;
 
+// Scene lines can be several KB; keep bursts buffered while a render blocks loop().
+constexpr size_t kSerialRxBufferSize = 32768;
+
 void setup()
 {
   auto cfg = M5.config();
+  // Serial is started below so its RX buffer can be enlarged first; a running UART cannot be resized.
+  cfg.serial_baudrate = 0;
   M5.begin(cfg);
 
   M5.Display.setRotation(1);
@@ -19,8 +25,12 @@ void setup()
 
   papr::InitializeCanvas(canvas, M5.Display.width(), M5.Display.height());
 
+  const size_t rxBufferSize = Serial.setRxBufferSize(kSerialRxBufferSize);
   Serial.begin(115200);
   delay(100);
+  if (rxBufferSize != kSerialRxBufferSize) {
+    Serial.printf("Serial RX buffer resize failed (requested %u)\n", static_cast<unsigned>(kSerialRxBufferSize));
+  }
   Serial.println("Papr monitor ready");
 }
 
@@ -33,11 +43,13 @@ void loop()
     if (c == '\n' || c == '\r') {
       inputLine.trim();
       if (inputLine.length() > 0) {
-        papr::HandleCommand(canvas, inputLine);
+        papr::EnqueueCommand(inputLine);
         inputLine = "";
       }
     } else if (static_cast<uint8_t>(c) >= 32) {
       inputLine += c;
     }
   }
+
+  papr::ProcessNextCommand(canvas);
 }
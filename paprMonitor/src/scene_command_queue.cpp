@@ -0,0 +1,153 @@
+#include "scene_command_queue.h"
+
+#include "chart_renderer.h"
+#include "scene_json_protocol.h"
+#include "scene_renderer.h"
+
+#include <deque>
+#include <utility>
+
+namespace papr {
+
+namespace {
+
+constexpr size_t kMaxPendingCommands = 8;
+
+enum class CommandKind {
+  Scene,
+  Clear,
+  Stats,
+  Other
+};
+
+struct PendingCommand {
+  CommandKind kind;
+  String text;
+};
+
+std::deque<PendingCommand> pendingCommands;
+uint32_t coalescedSceneCount = 0;
+uint32_t rejectedSceneCount = 0;
+
+CommandKind ClassifyCommand(const String& cmd)
+{
+  if (cmd.startsWith("{")) {
+    return CommandKind::Scene;
+  }
+
+  if (cmd == "clear") {
+    return CommandKind::Clear;
+  }
+
+  if (cmd == "stats") {
+    return CommandKind::Stats;
+  }
+
+  return CommandKind::Other;
+}
+
+// Chart `Values`/`Append` are incremental state, so a dropped scene still has to
+// feed its retained series before it is discarded.
+void MergeSupersededScene(const String& json)
+{
+  if (json.indexOf("\"Chart\"") < 0) {
+    return;
+  }
+
+  JsonDocument doc;
+  JsonObjectConst root;
+  if (!TryParseSceneJson(json, doc, root)) {
+    return;
+  }
+
+  UpdateChartSeries(root["Shapes"].as<JsonArrayConst>());
+}
+
+bool ReplacesScreen(CommandKind kind)
+{
+  return kind == CommandKind::Scene || kind == CommandKind::Clear;
+}
+
+// A scene or clear redraws the whole panel, so any scene/clear still waiting
+// in the queue would only be overwritten. Drop those before queuing the new one.
+void DropSupersededCommands()
+{
+  for (auto it = pendingCommands.begin(); it != pendingCommands.end();) {
+    if (!ReplacesScreen(it->kind)) {
+      ++it;
+      continue;
+    }
+
+    if (it->kind == CommandKind::Scene) {
+      MergeSupersededScene(it->text);
+      ++coalescedSceneCount;
+      Serial.printf("Scene coalesced (total %u)\n", static_cast<unsigned>(coalescedSceneCount));
+    }
+
+    it = pendingCommands.erase(it);
+  }
+}
+
+// Makes room for one more command without ever evicting the pending scene/clear.
+// Returns false when the incoming command has to be rejected instead.
+bool ReserveQueueSlot()
+{
+  if (pendingCommands.size() < kMaxPendingCommands) {
+    return true;
+  }
+
+  for (auto it = pendingCommands.begin(); it != pendingCommands.end(); ++it) {
+    if (!ReplacesScreen(it->kind)) {
+      Serial.printf("Command queue full: dropping '%.24s'\n", it->text.c_str());
+      pendingCommands.erase(it);
+      return true;
+    }
+  }
+
+  Serial.println("Command queue full: rejecting command");
+  return false;
+}
+
+} // namespace
+
+void EnqueueCommand(const String& cmd)
+{
+  const CommandKind kind = ClassifyCommand(cmd);
+  if (kind == CommandKind::Stats) {
+    Serial.printf("Scenes coalesced: %u rejected: %u\n",
+                  static_cast<unsigned>(coalescedSceneCount),
+                  static_cast<unsigned>(rejectedSceneCount));
+    return;
+  }
+
+  // A truncated or garbled line must not supersede the last valid scene.
+  if (kind == CommandKind::Scene && !ValidateSceneJson(cmd)) {
+    ++rejectedSceneCount;
+    Serial.printf("Scene rejected (total %u)\n", static_cast<unsigned>(rejectedSceneCount));
+    return;
+  }
+
+  if (ReplacesScreen(kind)) {
+    DropSupersededCommands();
+  }
+
+  if (!ReserveQueueSlot()) {
+    return;
+  }
+
+  pendingCommands.push_back({kind, cmd});
+}
+
+bool ProcessNextCommand(M5Canvas& canvas)
+{
+  if (pendingCommands.empty()) {
+    return false;
+  }
+
+  const PendingCommand next = std::move(pendingCommands.front());
+  pendingCommands.pop_front();
+  HandleCommand(canvas, next.text);
+  return true;
+}
+
+} // namespace papr
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <M5Unified.h>
+
+namespace papr {
+
+void EnqueueCommand(const String& cmd);
+bool ProcessNextCommand(M5Canvas& canvas);
+
+} // namespace papr
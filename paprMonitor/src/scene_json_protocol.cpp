@@ -2,9 +2,10 @@
 
 namespace papr {
 
-bool TryParseSceneJson(const String& json, JsonDocument& doc, JsonObjectConst& root)
+namespace {
+
+bool CheckSceneRoot(const DeserializationError& error, JsonDocument& doc, JsonObjectConst& root)
 {
-  const DeserializationError error = deserializeJson(doc, json);
   if (error) {
     Serial.print("JSON Parse failed: ");
     Serial.println(error.c_str());
@@ -26,4 +27,23 @@ bool TryParseSceneJson(const String& json, JsonDocument& doc, JsonObjectConst& r
   return true;
 }
 
+} // namespace
+
+bool TryParseSceneJson(const String& json, JsonDocument& doc, JsonObjectConst& root)
+{
+  const DeserializationError error = deserializeJson(doc, json);
+  return CheckSceneRoot(error, doc, root);
+}
+
+bool ValidateSceneJson(const String& json)
+{
+  JsonDocument filter;
+  filter["Shapes"][0]["Kind"] = true;
+
+  JsonDocument doc;
+  JsonObjectConst root;
+  const DeserializationError error = deserializeJson(doc, json, DeserializationOption::Filter(filter));
+  return CheckSceneRoot(error, doc, root);
+}
+
 } // namespace papr
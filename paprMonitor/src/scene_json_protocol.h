@@ -5,5 +5,7 @@
 namespace papr {
 
 bool TryParseSceneJson(const String& json, JsonDocument& doc, JsonObjectConst& root);
+// Checks that `json` is a complete scene document without keeping the shape payloads.
+bool ValidateSceneJson(const String& json);
 
 } // namespace papr
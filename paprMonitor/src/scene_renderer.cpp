@@ -1,5 +1,6 @@
 #include "scene_renderer.h"
 
+#include "canvas_palette.h"
 #include "scene_json_protocol.h"
 #include "scene_shape_renderer.h"
 
@@ -46,8 +47,13 @@ void HandleSceneJsonCommand(M5Canvas& canvas, const String& json)
 
 void InitializeCanvas(M5Canvas& canvas, int width, int height)
 {
-  canvas.setColorDepth(8);
+  canvas.setColorDepth(4);
   canvas.createSprite(width, height);
+  for (int i = 0; i < kCanvasGrayLevels; ++i) {
+    const uint8_t g = static_cast<uint8_t>((i * 255) / (kCanvasGrayLevels - 1));
+    canvas.setPaletteColor(i, g, g, g);
+  }
+
   canvas.setFont(&fonts::FreeSans12pt7b);
   canvas.setTextSize(1);
   canvas.setTextColor(TFT_BLACK, TFT_WHITE);
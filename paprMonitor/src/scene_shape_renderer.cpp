@@ -1,5 +1,7 @@
 #include "scene_shape_renderer.h"
 
+#include "chart_renderer.h"
+#include "icon_atlas.h"
 #include "image_matrix_renderer.h"
 #include "scene_geometry.h"
 
@@ -54,6 +56,23 @@ void SetApproxFont(M5Canvas& canvas, double fontSize)
   canvas.setTextDatum(TL_DATUM);
 }
 
+// Gray ImageMatrix content only survives a grayscale EPD waveform.
+bool NeedsGrayscaleWaveform(JsonObjectConst shape)
+{
+  if (GetText(shape, "Kind") != "Image") {
+    return false;
+  }
+
+  const JsonObjectConst matrix = shape["ImageMatrix"].as<JsonObjectConst>();
+  if (matrix.isNull()) {
+    return false;
+  }
+
+  const int bpp = matrix["Bpp"] | 1;
+  const bool dither = matrix["Dither"] | false;
+  return bpp > 1 && !dither;
+}
+
 void DrawSceneShape(M5Canvas& canvas, JsonObjectConst shape)
 {
   const String kind = GetText(shape, "Kind");
@@ -148,6 +167,10 @@ void DrawSceneShape(M5Canvas& canvas, JsonObjectConst shape)
   if (kind == "Icon") {
     const String icon = GetText(shape, "IconKey", "*");
     const double size = GetNumber(shape, "Size", 24);
+    if (DrawAtlasIcon(canvas, icon, IRound(pos.x), IRound(pos.y), size)) {
+      return;
+    }
+
     SetApproxFont(canvas, size);
     canvas.drawString(icon, IRound(pos.x), IRound(pos.y));
     return;
@@ -171,6 +194,22 @@ void DrawSceneShape(M5Canvas& canvas, JsonObjectConst shape)
     return;
   }
 
+  if (kind == "Chart") {
+    const double w = GetNumber(shape, "Width", 0);
+    const double h = GetNumber(shape, "Height", 0);
+    const int x = IRound(pos.x - (w * 0.5));
+    const int y = IRound(pos.y - (h * 0.5));
+    const int wi = max(1, IRound(w));
+    const int hi = max(1, IRound(h));
+
+    if (RenderChart(canvas, shape, x, y, wi, hi, lineWeight)) {
+      return;
+    }
+
+    canvas.drawRect(x, y, wi, hi, TFT_BLACK);
+    return;
+  }
+
   if (kind == "TextBox") {
     const double w = GetNumber(shape, "Width", 0);
     const double h = GetNumber(shape, "Height", 0);
@@ -306,12 +345,26 @@ bool RenderSceneFromRoot(M5Canvas& canvas, JsonObjectConst root)
   }
 
   canvas.fillSprite(TFT_WHITE);
+  BeginChartScene(shapes);
 
+  bool grayscale = false;
   for (JsonObjectConst shape : shapes) {
     DrawSceneShape(canvas, shape);
+    grayscale = grayscale || NeedsGrayscaleWaveform(shape);
+  }
+
+  EndChartScene();
+
+  if (grayscale) {
+    M5.Display.setEpdMode(epd_quality);
   }
 
   canvas.pushSprite(0, 0);
+
+  if (grayscale) {
+    M5.Display.waitDisplay();
+    M5.Display.setEpdMode(epd_fast);
+  }
   Serial.println("Scene rendered");
   return true;
 }